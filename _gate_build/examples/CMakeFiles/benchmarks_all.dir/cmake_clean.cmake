@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarks_all.dir/benchmarks/main.cpp.o"
+  "CMakeFiles/benchmarks_all.dir/benchmarks/main.cpp.o.d"
+  "benchmarks_all"
+  "benchmarks_all.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarks_all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_cifar_train.dir/cifar10/train.cpp.o"
+  "CMakeFiles/example_cifar_train.dir/cifar10/train.cpp.o.d"
+  "example_cifar_train"
+  "example_cifar_train.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_cifar_train.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
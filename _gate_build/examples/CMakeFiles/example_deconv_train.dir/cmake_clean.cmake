@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_deconv_train.dir/deconv/train.cpp.o"
+  "CMakeFiles/example_deconv_train.dir/deconv/train.cpp.o.d"
+  "example_deconv_train"
+  "example_deconv_train.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_deconv_train.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_mnist_test.dir/mnist/test_with_stb_image.cpp.o"
+  "CMakeFiles/example_mnist_test.dir/mnist/test_with_stb_image.cpp.o.d"
+  "example_mnist_test"
+  "example_mnist_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_mnist_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
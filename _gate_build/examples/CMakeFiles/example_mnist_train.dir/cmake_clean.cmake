@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example_mnist_train.dir/mnist/train.cpp.o"
+  "CMakeFiles/example_mnist_train.dir/mnist/train.cpp.o.d"
+  "example_mnist_train"
+  "example_mnist_train.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_mnist_train.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/print_device.dir/print_device.cpp.o"
+  "CMakeFiles/print_device.dir/print_device.cpp.o.d"
+  "print_device"
+  "print_device.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/print_device.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
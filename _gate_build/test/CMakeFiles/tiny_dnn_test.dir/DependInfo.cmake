@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/test.cpp" "test/CMakeFiles/tiny_dnn_test.dir/test.cpp.o" "gcc" "test/CMakeFiles/tiny_dnn_test.dir/test.cpp.o.d"
+  "/root/repo/test/test_no_duplicate_symbols.cpp" "test/CMakeFiles/tiny_dnn_test.dir/test_no_duplicate_symbols.cpp.o" "gcc" "test/CMakeFiles/tiny_dnn_test.dir/test_no_duplicate_symbols.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
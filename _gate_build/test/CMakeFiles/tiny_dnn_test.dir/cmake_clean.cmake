@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tiny_dnn_test.dir/test.cpp.o"
+  "CMakeFiles/tiny_dnn_test.dir/test.cpp.o.d"
+  "CMakeFiles/tiny_dnn_test.dir/test_no_duplicate_symbols.cpp.o"
+  "CMakeFiles/tiny_dnn_test.dir/test_no_duplicate_symbols.cpp.o.d"
+  "tiny_dnn_test"
+  "tiny_dnn_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tiny_dnn_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
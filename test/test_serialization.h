@@ -139,4 +139,44 @@ TEST(serialization, graph_model_and_weights) {
     EXPECT_FLOAT_EQ(res1[1], res2[1]);
 }
 
+TEST(serialization, unregistered_layer_type_throws_on_binary_save) {
+    // a layer type with no entry for the binary archive pair must fail the
+    // save loudly, including on the parallel per-layer path
+    struct unregistered_fc : fully_connected_layer<tan_h> {
+        unregistered_fc() : fully_connected_layer<tan_h>(3, 2) {}
+    };
+
+    unregistered_fc l;
+    std::vector<layerptr_t> v;
+    v.push_back(&l);
+
+    std::ostringstream ss(std::ios::binary);
+    cereal::BinaryOutputArchive oa(ss);
+
+    bool thrown = false;
+    try {
+        cereal::save(oa, v);
+    } catch (const nn_error&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+}
+
+TEST(serialization, serialized_size_matches_binary_output) {
+    fully_connected_layer<tan_h> fc(10, 4);
+
+    auto& helper = serialization_helper<cereal::BinaryInputArchive,
+                                        cereal::BinaryOutputArchive>::get_instance();
+
+    size_t predicted = helper.serialized_size(typeid(fc), &fc);
+
+    std::ostringstream ss(std::ios::binary);
+    {
+        cereal::BinaryOutputArchive oa(ss);
+        layer::save_layer(oa, fc);
+    }
+
+    EXPECT_EQ(predicted, ss.str().size());
+}
+
 } // namespace tiny-dnn
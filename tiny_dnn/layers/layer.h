@@ -597,8 +597,7 @@ class layer : public node {
     static void save_layer(OutputArchive & oa, const layer& l) {
         typedef typename cereal::traits::detail::get_input_from_output<OutputArchive>::type InputArchive;
 
-        std::string name = serialization_helper<InputArchive, OutputArchive>::get_instance().serialization_name(typeid(l));
-        serialization_helper<InputArchive, OutputArchive>::get_instance().save(name, oa, &l);
+        serialization_helper<InputArchive, OutputArchive>::get_instance().save(typeid(l), oa, &l);
     }
 
  protected:
@@ -48,8 +48,9 @@ enum class content_type {
 };
 
 enum class file_format {
-    binary,
-    json
+    binary, ///< recommended for production: no number<->text conversion cost
+    portable_binary, ///< endian-safe binary, needs CNN_USE_PORTABLE_BINARY_SERIALIZATION
+    json ///< human-readable, several times slower than binary
 };
 
 struct result {
@@ -565,7 +566,12 @@ public:
     void load(const std::string& filename,
               content_type       what     = content_type::weights_and_model,
               file_format        format   = file_format::binary) {
-        std::ifstream ifs(filename.c_str(), std::ios::binary | std::ios::in);
+        // tens-of-KB stream buffer: batches read() syscalls while staying
+        // cache-resident, unlike the implementation-default (often 8KB)
+        std::vector<char> io_buffer(64 * 1024);
+        std::ifstream ifs;
+        ifs.rdbuf()->pubsetbuf(&io_buffer[0], static_cast<std::streamsize>(io_buffer.size()));
+        ifs.open(filename.c_str(), std::ios::binary | std::ios::in);
         if (ifs.fail() || ifs.bad())
             throw nn_error("failed to open:" + filename);
 
@@ -576,6 +582,14 @@ public:
                 from_archive(bi, what);
             }
             break;
+#ifdef CNN_USE_PORTABLE_BINARY_SERIALIZATION
+            case file_format::portable_binary:
+            {
+                cereal::PortableBinaryInputArchive pbi(ifs);
+                from_archive(pbi, what);
+            }
+            break;
+#endif
             case file_format::json:
             {
                 cereal::JSONInputArchive ji(ifs);
@@ -590,7 +604,12 @@ public:
     void save(const std::string& filename,
               content_type       what     = content_type::weights_and_model,
               file_format        format   = file_format::binary) const {
-        std::ofstream ofs(filename.c_str(), std::ios::binary | std::ios::out);
+        // see load(): explicit stream buffer sized to batch syscalls without
+        // thrashing the cache
+        std::vector<char> io_buffer(64 * 1024);
+        std::ofstream ofs;
+        ofs.rdbuf()->pubsetbuf(&io_buffer[0], static_cast<std::streamsize>(io_buffer.size()));
+        ofs.open(filename.c_str(), std::ios::binary | std::ios::out);
         if (ofs.fail() || ofs.bad())
             throw nn_error("failed to open:" + filename);
 
@@ -601,6 +620,14 @@ public:
                 to_archive(bo, what);
             }
             break;
+#ifdef CNN_USE_PORTABLE_BINARY_SERIALIZATION
+            case file_format::portable_binary:
+            {
+                cereal::PortableBinaryOutputArchive pbo(ofs);
+                to_archive(pbo, what);
+            }
+            break;
+#endif
             case file_format::json:
             {
                 cereal::JSONOutputArchive jo(ofs);
@@ -26,6 +26,7 @@
 */
 #pragma once
 
+#include <exception>
 #include <vector>
 #include <tuple>
 #include <unordered_map>
@@ -46,6 +47,69 @@ void save(Archive & ar, const std::vector<tiny_dnn::layerptr_t>& v) {
     }
 }
 
+/**
+ * binary fast path: per-layer output sizes are exactly predictable, so each
+ * layer gets its own archive writing into a disjoint region of one buffer
+ * and the regions can be filled in parallel. Binary archives carry no
+ * header or document state, so the concatenated buffer is byte-identical
+ * to serializing every layer through the shared archive above.
+ **/
+inline void save(BinaryOutputArchive & ar, const std::vector<tiny_dnn::layerptr_t>& v) {
+    ar(cereal::make_size_tag((cereal::size_type)v.size()));
+
+    if (v.empty()) return;
+
+    size_t n = v.size();
+    auto& helper = tiny_dnn::serialization_helper<BinaryInputArchive,
+                                                  BinaryOutputArchive>::get_instance();
+
+    // exceptions must not escape the workers: the async-based parallel_for
+    // never collects them (and an OpenMP region would terminate), so each
+    // worker parks its failure here and the calling thread rethrows after
+    // the join - an unregistered layer type still throws out of save()
+    std::vector<std::exception_ptr> errors(n);
+
+    auto rethrow_worker_error = [&errors]() {
+        for (auto& e : errors) {
+            if (e) std::rethrow_exception(e);
+        }
+    };
+
+    std::vector<size_t> sizes(n);
+    tiny_dnn::for_i(true, n, [&](int i) {
+        try {
+            sizes[i] = helper.serialized_size(typeid(*v[i]), v[i]);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    }, 1);
+    rethrow_worker_error();
+
+    std::vector<size_t> offsets(n + 1, 0);
+    for (size_t i = 0; i < n; i++) {
+        offsets[i + 1] = offsets[i] + sizes[i];
+    }
+
+    std::vector<char> buf(offsets[n]);
+
+    tiny_dnn::for_i(true, n, [&](int i) {
+        try {
+            tiny_dnn::detail::array_streambuf sb(&buf[0] + offsets[i], sizes[i]);
+            std::ostream os(&sb);
+            BinaryOutputArchive oa(os);
+            tiny_dnn::layer::save_layer(oa, *v[i]);
+            if (sb.written() != sizes[i]) {
+                throw tiny_dnn::nn_error("layer serialization did not match its predicted size");
+            }
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    }, 1);
+    rethrow_worker_error();
+
+    ar.saveBinary(&buf[0], buf.size());
+}
+
 
 template <typename Archive>
 void load(Archive & ar, std::vector<std::shared_ptr<tiny_dnn::layer>>& v) {
@@ -25,12 +25,21 @@
     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #pragma once
-#include <typeindex>
-#include <map>
-#include <functional>
+#include <typeinfo>
+#include <unordered_map>
 #include <memory>
+#include <cassert>
+#include <cstring>
+#include <initializer_list>
+#include <ostream>
+#include <streambuf>
 #include <string>
+#include <type_traits>
+#include <vector>
 #include <cereal/archives/json.hpp>
+#ifdef CNN_USE_PORTABLE_BINARY_SERIALIZATION
+#include <cereal/archives/portable_binary.hpp>
+#endif
 #include <cereal/types/memory.hpp>
 #include "tiny_dnn/util/nn_error.h"
 #include "tiny_dnn/util/macro.h"
@@ -39,54 +48,140 @@ namespace tiny_dnn {
 
 class layer;
 
+namespace detail {
+
+/** discards everything written to it and counts the bytes, so the size of a
+ *  serialized object can be computed without materializing the output */
+class counting_streambuf : public std::streambuf {
+public:
+    counting_streambuf() : count_(0) {}
+
+    std::size_t count() const { return count_; }
+
+protected:
+    int overflow(int c) override {
+        if (c != traits_type::eof()) ++count_;
+        return c;
+    }
+
+    std::streamsize xsputn(const char*, std::streamsize n) override {
+        count_ += static_cast<std::size_t>(n);
+        return n;
+    }
+
+private:
+    std::size_t count_;
+};
+
+/** writes into a caller-owned byte range; overrunning the range fails the
+ *  stream instead of growing a buffer, which keeps concurrent writers on
+ *  disjoint ranges race-free */
+class array_streambuf : public std::streambuf {
+public:
+    array_streambuf(char* begin, std::size_t size) {
+        setp(begin, begin + size);
+    }
+
+    std::size_t written() const { return static_cast<std::size_t>(pptr() - pbase()); }
+};
+
+} // namespace detail
+
 template <typename InputArchive, typename OutputArchive>
 class serialization_helper {
 public:
-    void register_loader(const std::string& name, std::function<std::shared_ptr<layer>(InputArchive&)> func) {
-        loaders_[name] = [=](void* ar) {
-            return func(*reinterpret_cast<InputArchive*>(ar));
-        };
+    /** generator/saver entry - a plain function pointer, so each registration
+     *  stays allocation-free and each call is a single indirect call. The
+     *  class is already templated per archive pair, so the signatures can be
+     *  fully typed - no void* erasure between lookup and call */
+    typedef std::shared_ptr<layer> (*loader_t)(InputArchive&);
+    typedef void (*saver_t)(OutputArchive&, const layer*);
+
+    void register_loader(const std::string& name, loader_t func) {
+        entry(name).loader = func;
     }
 
-    template <typename T>
-    void register_saver(const std::string& name, std::function<void(OutputArchive&, const T*)> func) {
-        savers_[name] = [=](void* ar, const layer* l) {
-            return func(*reinterpret_cast<OutputArchive*>(ar), dynamic_cast<const T*>(l));
-        };
+    void register_saver(const std::string& name, saver_t func) {
+        entry(name).saver = func;
+    }
+
+    /** register a saver under both its name and its C++ type, so the write
+     *  path can dispatch without touching the string key */
+    void register_saver(const std::string& name, const std::type_info& index, saver_t func) {
+        registry_entry& e = entry(name);
+        e.saver = func;
+        e.type = &index;
+        by_type_.emplace(&index, &e);
     }
 
     template <typename T>
     void register_type(const std::string& name) {
-        type_names_[typeid(T)] = name;
+        registry_entry& e = entry(name);
+        e.type = &typeid(T);
+        by_type_.emplace(&typeid(T), &e);
     }
 
     std::shared_ptr<layer> load(const std::string& layer_name, InputArchive& ar) {
         check_if_serialization_enabled();
 
-        if (loaders_.find(layer_name) == loaders_.end()) {
+        auto it = registry_.find(layer_name);
+        if (it == registry_.end() || !it->second.loader) {
             throw nn_error("Failed to generate layer. Generator for " + layer_name + " is not found.\n"
                            "Please use CNN_REGISTER_LAYER_DESERIALIZER macro to register appropriate generator");
         }
 
-        return loaders_[layer_name](reinterpret_cast<void*>(&ar));
+        return it->second.loader(ar);
     }
 
     void save(const std::string& layer_name, OutputArchive & ar, const layer *l) {
         check_if_serialization_enabled();
 
-        if (savers_.find(layer_name) == savers_.end()) {
+        auto it = registry_.find(layer_name);
+        if (it == registry_.end() || !it->second.saver) {
             throw nn_error("Failed to generate layer. Generator for " + layer_name + " is not found.\n"
                 "Please use CNN_REGISTER_LAYER_DESERIALIZER macro to register appropriate generator");
         }
 
-        savers_[layer_name](reinterpret_cast<void*>(&ar), l);
+        it->second.saver(ar, l);
     }
 
-    std::string serialization_name(std::type_index index) const {
-        if (type_names_.find(index) == type_names_.end()) {
+    /** fast path for the write side: the concrete type is known from
+     *  typeid(l), so resolve the entry through the type-keyed reverse index
+     *  and skip the name round-trip */
+    void save(const std::type_info& index, OutputArchive& ar, const layer* l) {
+        check_if_serialization_enabled();
+
+        auto it = by_type_.find(&index);
+        if (it == by_type_.end() || !it->second->saver) {
             throw nn_error("Typename is not registered");
         }
-        return type_names_.at(index);
+
+        it->second->saver(ar, l);
+    }
+
+    /** number of bytes save(index, ...) would emit for *l, computed by a dry
+     *  run through a counting stream. Exact for the stateless binary
+     *  archives, so a destination buffer can be sized once and written in a
+     *  single shot; text archives thread document state across entries and
+     *  cannot be sized per-layer this way */
+    std::size_t serialized_size(const std::type_info& index, const layer* l) {
+        check_if_serialization_enabled();
+
+        detail::counting_streambuf cb;
+        std::ostream os(&cb);
+        OutputArchive oa(os);
+        save(index, oa, l);
+        return cb.count();
+    }
+
+    /** returned reference stays valid as long as the registration is alive,
+     *  so per-save callers don't pay for a copy of the name */
+    const std::string& serialization_name(const std::type_info& index) const {
+        auto it = by_type_.find(&index);
+        if (it == by_type_.end()) {
+            throw nn_error("Typename is not registered");
+        }
+        return *it->second->name;
     }
 
     static serialization_helper& get_instance() {
@@ -102,84 +197,292 @@ private:
 #endif
     }
 
-    /** layer-type -> generator  */
-    std::map<std::string, std::function<std::shared_ptr<layer>(void*)>> loaders_;
+    /** everything registered under one layer-type name, on one map node:
+     *  generator, saver, type and a pointer back to the key. name lookups
+     *  touch a single entry instead of parallel maps */
+    struct registry_entry {
+        loader_t loader;
+        saver_t saver;
+        const std::type_info* type;
+        const std::string* name;
+        registry_entry() : loader(nullptr), saver(nullptr), type(nullptr), name(nullptr) {}
+    };
+
+    /** find-or-insert the entry for a name; unordered_map node addresses are
+     *  stable, so by_type_ can safely point at mapped values and entries can
+     *  point at their keys */
+    registry_entry& entry(const std::string& name) {
+        auto res = registry_.emplace(name, registry_entry());
+        registry_entry& e = res.first->second;
+        e.name = &res.first->first;
+        return e;
+    }
+
+    /** within one process each type has a unique type_info object, so the
+     *  address is the key and hashing is a shift, not the string hash over
+     *  the mangled name that std::type_index costs on libstdc++ */
+    struct type_info_hash {
+        std::size_t operator()(const std::type_info* p) const {
+            return reinterpret_cast<std::size_t>(p) >> 3;
+        }
+    };
+
+    /** layer-type name -> entry */
+    std::unordered_map<std::string, registry_entry> registry_;
 
-    std::map<std::string, std::function<void(void*, const layer*)>> savers_;
+    /** layer type -> entry, for the write path where typeid is in hand */
+    std::unordered_map<const std::type_info*, registry_entry*, type_info_hash> by_type_;
 
-    std::map<std::type_index, std::string> type_names_;
+    /** enough buckets for every built-in layer x activation combination, so
+     *  the static-init registration storm never triggers a rehash and the
+     *  bucket array is allocated once, contiguously */
+    static const std::size_t kInitialLayerCount = 128;
 
-    serialization_helper() {}
+    serialization_helper() {
+        registry_.reserve(kInitialLayerCount);
+        by_type_.reserve(kInitialLayerCount);
+    }
 };
 
 namespace detail {
 
+/** one heap block carrying both the uninitialized layer storage and the
+ *  "constructed" flag used by load_layer_impl.
+ *  buf is value-initialized (zeroed) so that the enable_shared_from_this
+ *  base reads as unassigned when the shared_ptr ctor inspects the
+ *  not-yet-constructed object */
+template <typename T>
+struct layer_load_storage {
+    typename std::aligned_storage<sizeof(T), CNN_ALIGNOF(T)>::type buf;
+    bool constructed;
+    layer_load_storage() : buf(), constructed(false) {}
+};
+
+/** thread-local free list of deserialization blocks, so loading many layers
+ *  (or reloading models) reuses storage instead of hitting the allocator for
+ *  every layer */
+template <typename ST>
+struct storage_pool {
+    static ST* acquire() {
+        std::vector<ST*>& fl = instance().blocks;
+        if (!fl.empty()) {
+            ST* p = fl.back();
+            fl.pop_back();
+            // reused blocks must read as zeroed, same as a fresh new ST()
+            std::memset(static_cast<void*>(p), 0, sizeof(ST));
+            return p;
+        }
+        return new ST();
+    }
+
+    static void release(ST* p) {
+        // blocks released after the thread-local holder is gone - e.g. by a
+        // static-storage network whose layers outlive main's thread_locals -
+        // must not touch the dead vector; hand them straight back to the
+        // allocator, as the pre-pool code always did
+        if (!alive()) {
+            delete p;
+            return;
+        }
+        instance().blocks.push_back(p);
+    }
+
+private:
+    struct holder {
+        std::vector<ST*> blocks;
+
+        holder() { alive() = true; }
+
+        ~holder() {
+            for (ST* p : blocks) delete p;
+            alive() = false;
+        }
+    };
+
+    /** records whether the holder is currently within its lifetime. Lives
+     *  outside the holder in a trivially-destructible thread_local, so
+     *  reading it after the holder's destructor has run is well-defined -
+     *  re-entering instance() at that point would not be */
+    static bool& alive() {
+        static thread_local bool alive_flag = false;
+        return alive_flag;
+    }
+
+    static holder& instance() {
+        static thread_local holder h;
+        return h;
+    }
+};
+
 template <typename InputArchive, typename T>
 std::shared_ptr<T> load_layer_impl(InputArchive& ia) {
 
-    using ST = typename std::aligned_storage<sizeof(T), CNN_ALIGNOF(T)>::type;
+    typedef layer_load_storage<T> ST;
 
-    auto valid = std::make_shared<bool>(false);
+    ST* s = storage_pool<ST>::acquire();
 
-    std::shared_ptr<T> bn;
-    bn.reset(reinterpret_cast<T*>(new ST()),
-        [=](T* t) {
-        if (*valid)
+    std::shared_ptr<T> bn(reinterpret_cast<T*>(&s->buf), [s](T* t) {
+        if (s->constructed)
             t->~T();
-        delete reinterpret_cast<ST*>(t);
+        storage_pool<ST>::release(s);
     });
 
     cereal::memory_detail::LoadAndConstructLoadWrapper<InputArchive, T> wrapper(bn.get());
 
     wrapper.CEREAL_SERIALIZE_FUNCTION_NAME(ia);
 
-    *valid = true;
+    s->constructed = true;
     return bn;
 }
 
+/** memoized serialization_name lookup: the registry is hit once per
+ *  (archive pair, T) for the whole program, after which callers get the
+ *  already-resolved reference from a static local */
+template <typename InputArchive, typename OutputArchive, typename T>
+const std::string& cached_serialization_name() {
+    static const std::string& name =
+        serialization_helper<InputArchive, OutputArchive>::get_instance().serialization_name(typeid(T));
+    return name;
+}
+
 template <typename OutputArchive, typename T>
 void save_layer_impl(OutputArchive& oa, const T *layer) {
     typedef typename cereal::traits::detail::get_input_from_output<OutputArchive>::type InputArchive;
 
-    oa (cereal::make_nvp(serialization_helper<InputArchive, OutputArchive>::get_instance().serialization_name(typeid(T)), *layer));
+    oa (cereal::make_nvp(cached_serialization_name<InputArchive, OutputArchive, T>(), *layer));
+}
+
+/** non-capturing trampolines with the exact signatures stored in the
+ *  registry, so registration needs no std::function wrapper */
+template <typename InputArchive, typename T>
+std::shared_ptr<layer> load_layer_tramp(InputArchive& ar) {
+    return load_layer_impl<InputArchive, T>(ar);
+}
+
+template <typename OutputArchive, typename T>
+void save_layer_tramp(OutputArchive& ar, const layer* l) {
+    // the registry entry was selected by l's exact registered type, so the
+    // downcast cannot fail; keep the RTTI check in debug builds only
+    assert(dynamic_cast<const T*>(l) == static_cast<const T*>(l));
+    save_layer_impl<OutputArchive, T>(ar, static_cast<const T*>(l));
+}
+
+template <typename InputArchive, typename OutputArchive, typename T>
+void register_layer_serializer(const std::string& s) {
+    serialization_helper<InputArchive, OutputArchive>::get_instance().register_loader(s, &load_layer_tramp<InputArchive, T>);
+    serialization_helper<InputArchive, OutputArchive>::get_instance().template register_type<T>(s);
+    serialization_helper<InputArchive, OutputArchive>::get_instance().register_saver(s, typeid(T), &save_layer_tramp<OutputArchive, T>);
 }
 
 template <typename InputArchive, typename OutputArchive, typename T>
 struct automatic_layer_generator_register {
     explicit automatic_layer_generator_register(const std::string& s) {
-        serialization_helper<InputArchive, OutputArchive>::get_instance().register_loader(s, load_layer_impl<InputArchive, T>);
-        serialization_helper<InputArchive, OutputArchive>::get_instance().template register_type<T>(s);
-        serialization_helper<InputArchive, OutputArchive>::get_instance().template register_saver<T>(s, save_layer_impl<OutputArchive, T>);
+        register_layer_serializer<InputArchive, OutputArchive, T>(s);
+    }
+};
+
+/** registers every Ts under "base<act>" from one static object, instead of
+ *  one registrar global (guard variable + ctor call) per activation */
+template <typename InputArchive, typename OutputArchive, typename... Ts>
+struct layer_pack_register {
+    layer_pack_register(const std::string& base, std::initializer_list<const char*> act_names) {
+        assert(act_names.size() == sizeof...(Ts));
+        const char* const* act = act_names.begin();
+        int dummy[] = {
+            (register_layer_serializer<InputArchive, OutputArchive, Ts>(base + "<" + *act++ + ">"), 0)...
+        };
+        CNN_UNREFERENCED_PARAMETER(dummy);
     }
 };
 
 } // namespace detail
 
+/**
+ * fast path for callers that know the concrete layer type at compile time:
+ * resolves straight to the (de)serialization implementation for T, skipping
+ * the singleton guard, the name lookup and the registry indirection. The
+ * registry path stays for the usual case where the type name is parsed out
+ * of the archive at runtime.
+ **/
+template <typename T, typename InputArchive>
+std::shared_ptr<T> load_layer_fast(InputArchive& ia) {
+    return detail::load_layer_impl<InputArchive, T>(ia);
+}
+
+template <typename OutputArchive, typename T>
+void save_layer_fast(OutputArchive& oa, const T* l) {
+    detail::save_layer_impl<OutputArchive, T>(oa, l);
+}
+
 template <typename OutputArchive, typename T>
 void serialize_prolog(OutputArchive& oa, const T*) {
     typedef typename cereal::traits::detail::get_input_from_output<OutputArchive>::type InputArchive;
 
     oa(cereal::make_nvp("type",
-                        serialization_helper<InputArchive, OutputArchive>::get_instance()
-                        .serialization_name(typeid(T))));
+                        detail::cached_serialization_name<InputArchive, OutputArchive, T>()));
 }
 
+namespace detail {
+
+/** tag dispatch for the per-layer archive hooks: only JSON input needs the
+ *  explicit node begin/end, every other archive resolves to an empty inline
+ *  body at compile time */
 template <typename T>
-void start_loading_layer(T & ar) {}
+inline void start_loading_layer(T &, std::false_type) {}
 
 template <typename T>
-void finish_loading_layer(T & ar) {}
+inline void finish_loading_layer(T &, std::false_type) {}
+
+inline void start_loading_layer(cereal::JSONInputArchive & ia, std::true_type) { ia.startNode(); }
 
-inline void start_loading_layer(cereal::JSONInputArchive & ia) { ia.startNode(); }
+inline void finish_loading_layer(cereal::JSONInputArchive & ia, std::true_type) { ia.finishNode(); }
 
-inline void finish_loading_layer(cereal::JSONInputArchive & ia) { ia.finishNode(); }
+} // namespace detail
+
+template <typename T>
+inline void start_loading_layer(T & ar) {
+    detail::start_loading_layer(ar, typename std::is_same<T, cereal::JSONInputArchive>::type());
+}
+
+template <typename T>
+inline void finish_loading_layer(T & ar) {
+    detail::finish_loading_layer(ar, typename std::is_same<T, cereal::JSONInputArchive>::type());
+}
 
 } // namespace tiny_dnn
 
-#define CNN_REGISTER_LAYER_SERIALIZER_BODY(layer_type, layer_name, unique_name) \
-static tiny_dnn::detail::automatic_layer_generator_register<cereal::JSONInputArchive, cereal::JSONOutputArchive, layer_type> s_register_##unique_name(layer_name);\
+/**
+ * Per-archive registration macros. Binary is the recommended production
+ * format: JSON spends most of its time on number<->text conversion and is
+ * several times slower for model I/O, so keep it for human inspection and
+ * interchange only. Builds that never touch one format can register just the
+ * other to cut template instantiations and binary size.
+ **/
+#define CNN_REGISTER_LAYER_SERIALIZER_BODY_JSON(layer_type, layer_name, unique_name) \
+static tiny_dnn::detail::automatic_layer_generator_register<cereal::JSONInputArchive, cereal::JSONOutputArchive, layer_type> s_register_##unique_name(layer_name)
+
+#define CNN_REGISTER_LAYER_SERIALIZER_BODY_BINARY(layer_type, layer_name, unique_name) \
 static tiny_dnn::detail::automatic_layer_generator_register<cereal::BinaryInputArchive, cereal::BinaryOutputArchive, layer_type> s_register_binary_##unique_name(layer_name)
 
+#ifdef CNN_USE_PORTABLE_BINARY_SERIALIZATION
+
+/** endian-safe binary: still far cheaper than JSON, opt-in via CNN_USE_PORTABLE_BINARY_SERIALIZATION */
+#define CNN_REGISTER_LAYER_SERIALIZER_BODY_PORTABLE_BINARY(layer_type, layer_name, unique_name) \
+static tiny_dnn::detail::automatic_layer_generator_register<cereal::PortableBinaryInputArchive, cereal::PortableBinaryOutputArchive, layer_type> s_register_portable_binary_##unique_name(layer_name)
+
+#define CNN_REGISTER_LAYER_SERIALIZER_BODY(layer_type, layer_name, unique_name) \
+CNN_REGISTER_LAYER_SERIALIZER_BODY_JSON(layer_type, layer_name, unique_name);\
+CNN_REGISTER_LAYER_SERIALIZER_BODY_BINARY(layer_type, layer_name, unique_name);\
+CNN_REGISTER_LAYER_SERIALIZER_BODY_PORTABLE_BINARY(layer_type, layer_name, unique_name)
+
+#else
+
+#define CNN_REGISTER_LAYER_SERIALIZER_BODY(layer_type, layer_name, unique_name) \
+CNN_REGISTER_LAYER_SERIALIZER_BODY_JSON(layer_type, layer_name, unique_name);\
+CNN_REGISTER_LAYER_SERIALIZER_BODY_BINARY(layer_type, layer_name, unique_name)
+
+#endif // CNN_USE_PORTABLE_BINARY_SERIALIZATION
+
 #define CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATION(layer_type, activation_type, layer_name) \
 CNN_REGISTER_LAYER_SERIALIZER_BODY(layer_type<tiny_dnn::activation::activation_type>, #layer_name "<" #activation_type ">", layer_name##_##activation_type)
 
@@ -199,19 +502,42 @@ CNN_REGISTER_LAYER_SERIALIZER_BODY(layer_type<tiny_dnn::activation::activation_t
 #define CNN_REGISTER_LAYER_SERIALIZER(layer_type, layer_name) \
 CNN_REGISTER_LAYER_SERIALIZER_BODY(layer_type, #layer_name, layer_name)
 
+/** every built-in activation, instantiated for one layer template; kept in
+ *  sync with CNN_ACTIVATION_NAME_LIST below */
+#define CNN_ACTIVATION_PACK(layer_type) \
+layer_type<tiny_dnn::activation::tan_h>, \
+layer_type<tiny_dnn::activation::softmax>, \
+layer_type<tiny_dnn::activation::identity>, \
+layer_type<tiny_dnn::activation::sigmoid>, \
+layer_type<tiny_dnn::activation::relu>, \
+layer_type<tiny_dnn::activation::leaky_relu>, \
+layer_type<tiny_dnn::activation::elu>, \
+layer_type<tiny_dnn::activation::tan_hp1m2>
+
+#define CNN_ACTIVATION_NAME_LIST \
+{ "tan_h", "softmax", "identity", "sigmoid", "relu", "leaky_relu", "elu", "tan_hp1m2" }
+
+#ifdef CNN_USE_PORTABLE_BINARY_SERIALIZATION
+
+#define CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATIONS_PORTABLE_BINARY(layer_type, layer_name) \
+static tiny_dnn::detail::layer_pack_register<cereal::PortableBinaryInputArchive, cereal::PortableBinaryOutputArchive, CNN_ACTIVATION_PACK(layer_type)> s_register_acts_portable_binary_##layer_name(#layer_name, CNN_ACTIVATION_NAME_LIST);
+
+#else
+
+#define CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATIONS_PORTABLE_BINARY(layer_type, layer_name)
+
+#endif // CNN_USE_PORTABLE_BINARY_SERIALIZATION
+
 /**
- * Register layer serializer
- * @todo we need to find better (easier to maintain) way to handle multiple activations
+ * Register layer serializer for every built-in activation.
+ * One registrar object per archive pair covers the whole activation pack,
+ * instead of a separate global (with its own guard variable and constructor
+ * call) per activation.
  **/
 #define CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATIONS(layer_type, layer_name) \
-CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATION(layer_type, tan_h, layer_name); \
-CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATION(layer_type, softmax, layer_name); \
-CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATION(layer_type, identity, layer_name); \
-CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATION(layer_type, sigmoid, layer_name); \
-CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATION(layer_type, relu, layer_name); \
-CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATION(layer_type, leaky_relu, layer_name); \
-CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATION(layer_type, elu, layer_name); \
-CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATION(layer_type, tan_hp1m2, layer_name)
+CNN_REGISTER_LAYER_SERIALIZER_WITH_ACTIVATIONS_PORTABLE_BINARY(layer_type, layer_name) \
+static tiny_dnn::detail::layer_pack_register<cereal::JSONInputArchive, cereal::JSONOutputArchive, CNN_ACTIVATION_PACK(layer_type)> s_register_acts_##layer_name(#layer_name, CNN_ACTIVATION_NAME_LIST); \
+static tiny_dnn::detail::layer_pack_register<cereal::BinaryInputArchive, cereal::BinaryOutputArchive, CNN_ACTIVATION_PACK(layer_type)> s_register_acts_binary_##layer_name(#layer_name, CNN_ACTIVATION_NAME_LIST)
 
 #endif // CNN_NO_SERIALIZATION
 